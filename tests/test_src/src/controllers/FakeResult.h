@@ -0,0 +1,31 @@
+#pragma once
+
+#include <drogon/orm/Result.h>
+// Not installed by Drogon; found through the orm_lib/src include path of the test build
+#include "ResultImpl.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// In-memory result so handlers see real rows instead of the not-found path
+class FakeResultImpl : public drogon::orm::ResultImpl {
+public:
+    FakeResultImpl(std::vector<std::string> columns, std::vector<std::vector<std::string>> rows)
+        : columns_(std::move(columns)), rows_(std::move(rows)) {}
+
+    SizeType size() const noexcept override { return rows_.size(); }
+    RowSizeType columns() const noexcept override { return columns_.size(); }
+    const char *columnName(RowSizeType number) const override { return columns_[number].c_str(); }
+    SizeType affectedRows() const noexcept override { return rows_.size(); }
+    const char *getValue(SizeType row, RowSizeType column) const override { return rows_[row][column].c_str(); }
+    bool isNull(SizeType, RowSizeType) const override { return false; }
+    FieldSizeType getLength(SizeType row, RowSizeType column) const override { return rows_[row][column].size(); }
+
+private:
+    std::vector<std::string> columns_;
+    std::vector<std::vector<std::string>> rows_;
+};
+
+inline drogon::orm::Result makeResult(std::vector<std::string> columns, std::vector<std::vector<std::string>> rows) {
+    return drogon::orm::Result(std::make_shared<FakeResultImpl>(std::move(columns), std::move(rows)));
+}
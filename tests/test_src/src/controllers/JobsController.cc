@@ -3,7 +3,14 @@
 #include <drogon/HttpAppFramework.h>
 #include <drogon/HttpRequest.h>
 #include <drogon/HttpResponse.h>
+#include <trantor/net/EventLoopThread.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <regex>
+#include <thread>
 #include "JobsController.h"
+#include "FakeResult.h"
 #include "../models/Job.h"
 #include "../models/Person.h"
 
@@ -53,6 +60,297 @@ TEST_F(JobsControllerTest, GetJobs_Success) {
     controller.get(req, callback);
 }
 
+// Disabled until the upstream list handlers support keyset pagination (`after` / `next_cursor`)
+TEST_F(JobsControllerTest, DISABLED_GetJobs_WithCursor_Success) {
+    // Arrange
+    auto firstReq = HttpRequest::newHttpRequest();
+    firstReq->setParameter("limit", "2");
+    firstReq->setParameter("sort_field", "title");
+    firstReq->setParameter("sort_order", "asc");
+    std::string cursor;
+    bool secondPageServed = false;
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .WillOnce(Invoke([](const std::string &, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            successCallback(makeResult({"id", "title"}, {{"11", "Analyst"}, {"12", "Designer"}}));
+        }))
+        .WillOnce(Invoke([](const std::string &sql, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            // Keyset mode seeks past the (sort value, id) of the cursor instead of skipping rows
+            EXPECT_EQ(sql.find("OFFSET"), std::string::npos);
+            EXPECT_TRUE(std::regex_search(sql, std::regex(R"re(\(\s*"?title"?\s*,\s*"?id"?\s*\)\s*>)re")));
+            successCallback(makeResult({"id", "title"}, {{"13", "Engineer"}, {"14", "Manager"}}));
+        }));
+
+    controller.get(firstReq, [&cursor](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        auto json = resp->getJsonObject();
+        ASSERT_EQ((*json)["items"].size(), 2u);
+        ASSERT_EQ((*json)["items"][1]["id"].asInt(), 12);
+        cursor = (*json)["next_cursor"].asString();
+    });
+    ASSERT_FALSE(cursor.empty());
+
+    // The cursor is opaque: it is only ever echoed back
+    auto secondReq = HttpRequest::newHttpRequest();
+    secondReq->setParameter("limit", "2");
+    secondReq->setParameter("sort_field", "title");
+    secondReq->setParameter("sort_order", "asc");
+    secondReq->setParameter("after", cursor);
+
+    // Act
+    controller.get(secondReq, [&](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        auto json = resp->getJsonObject();
+        ASSERT_EQ((*json)["items"].size(), 2u);
+        ASSERT_EQ((*json)["items"][0]["id"].asInt(), 13);
+        ASSERT_TRUE((*json)["next_cursor"].isString());
+        ASSERT_NE((*json)["next_cursor"].asString(), cursor);
+        secondPageServed = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(secondPageServed);
+}
+
+// Disabled until the upstream list handlers support keyset pagination (`after` / `next_cursor`)
+TEST_F(JobsControllerTest, DISABLED_GetJobs_WithCursor_LastPage_NullNextCursor) {
+    // Arrange
+    auto firstReq = HttpRequest::newHttpRequest();
+    firstReq->setParameter("limit", "2");
+    firstReq->setParameter("sort_field", "title");
+    firstReq->setParameter("sort_order", "asc");
+    std::string cursor;
+    bool secondPageServed = false;
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .WillOnce(Invoke([](const std::string &, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            successCallback(makeResult({"id", "title"}, {{"11", "Analyst"}, {"12", "Designer"}}));
+        }))
+        .WillOnce(Invoke([](const std::string &sql, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            // Keyset mode seeks past the (sort value, id) of the cursor instead of skipping rows
+            EXPECT_EQ(sql.find("OFFSET"), std::string::npos);
+            EXPECT_TRUE(std::regex_search(sql, std::regex(R"re(\(\s*"?title"?\s*,\s*"?id"?\s*\)\s*>)re")));
+            successCallback(makeResult({"id", "title"}, {{"13", "Engineer"}}));
+        }));
+
+    controller.get(firstReq, [&cursor](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        auto json = resp->getJsonObject();
+        ASSERT_EQ((*json)["items"].size(), 2u);
+        ASSERT_EQ((*json)["items"][1]["id"].asInt(), 12);
+        cursor = (*json)["next_cursor"].asString();
+    });
+    ASSERT_FALSE(cursor.empty());
+
+    // The cursor is opaque: it is only ever echoed back
+    auto secondReq = HttpRequest::newHttpRequest();
+    secondReq->setParameter("limit", "2");
+    secondReq->setParameter("sort_field", "title");
+    secondReq->setParameter("sort_order", "asc");
+    secondReq->setParameter("after", cursor);
+
+    // Act
+    controller.get(secondReq, [&](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        auto json = resp->getJsonObject();
+        ASSERT_EQ((*json)["items"].size(), 1u);
+        ASSERT_EQ((*json)["items"][0]["id"].asInt(), 13);
+        // Short page: no further data, so next_cursor is null or absent
+        ASSERT_TRUE((*json)["next_cursor"].isNull());
+        secondPageServed = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(secondPageServed);
+}
+
+// Disabled until the upstream controllers emit ETags and honor If-None-Match
+TEST_F(JobsControllerTest, DISABLED_GetJobs_MatchingIfNoneMatch_NotModified) {
+    // Arrange
+    auto req = HttpRequest::newHttpRequest();
+    req->setParameter("offset", "0");
+    req->setParameter("limit", "10");
+    std::string etag;
+    bool notModified = false;
+
+    auto firstCallback = [&etag](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        etag = resp->getHeader("ETag");
+    };
+
+    auto secondCallback = [&notModified](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k304NotModified);
+        ASSERT_TRUE(resp->body().empty());
+        notModified = true;
+    };
+
+    // The conditional request must not run the query
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .Times(1)
+        .WillOnce(Invoke([](const std::string &, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            successCallback(makeResult({"id", "title"}, {{"1", "Engineer"}, {"2", "Manager"}}));
+        }));
+
+    // Act
+    controller.get(req, firstCallback);
+    // Strong validator: quoted, no W/ prefix
+    ASSERT_GT(etag.size(), 2u);
+    ASSERT_EQ(etag.front(), '"');
+    ASSERT_EQ(etag.back(), '"');
+
+    auto conditionalReq = HttpRequest::newHttpRequest();
+    conditionalReq->setParameter("offset", "0");
+    conditionalReq->setParameter("limit", "10");
+    conditionalReq->addHeader("If-None-Match", etag);
+    controller.get(conditionalReq, secondCallback);
+
+    // Assert
+    ASSERT_TRUE(notModified);
+}
+
+// Disabled until the upstream batched relation loader and ?expand=persons land
+TEST_F(JobsControllerTest, DISABLED_GetJobs_ExpandPersons_SingleBatchedQuery) {
+    // Arrange
+    auto req = HttpRequest::newHttpRequest();
+    req->setParameter("offset", "0");
+    req->setParameter("limit", "10");
+    req->setParameter("expand", "persons");
+    std::vector<std::string> statements;
+    bool called = false;
+
+    auto callback = [&called](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        auto json = resp->getJsonObject();
+        ASSERT_EQ(json->size(), 2u);
+        ASSERT_EQ((*json)[0]["persons"].size(), 1u);
+        ASSERT_EQ((*json)[1]["persons"].size(), 1u);
+        called = true;
+    };
+
+    // One query for the jobs page and one for the persons of every job on it
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .Times(2)
+        .WillOnce(Invoke([&statements](const std::string &sql, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            statements.push_back(sql);
+            successCallback(makeResult({"id", "title"}, {{"1", "Engineer"}, {"2", "Manager"}}));
+        }))
+        .WillOnce(Invoke([&statements](const std::string &sql, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            statements.push_back(sql);
+            successCallback(makeResult({"id", "job_id", "first_name"}, {{"10", "1", "Ada"}, {"20", "2", "Alan"}}));
+        }));
+
+    // Act
+    controller.get(req, callback);
+
+    // Assert
+    ASSERT_TRUE(called);
+    ASSERT_EQ(statements.size(), 2u);
+    ASSERT_NE(statements[1].find("ANY("), std::string::npos);
+}
+
+// Disabled until the upstream batched relation loader and ?expand=persons land
+TEST_F(JobsControllerTest, DISABLED_GetJobs_ExpandPersons_BatchesCallersWithinOneLoopTick) {
+    // Arrange
+    auto firstReq = HttpRequest::newHttpRequest();
+    firstReq->setParameter("offset", "0");
+    firstReq->setParameter("limit", "1");
+    firstReq->setParameter("expand", "persons");
+    auto secondReq = HttpRequest::newHttpRequest();
+    secondReq->setParameter("offset", "1");
+    secondReq->setParameter("limit", "1");
+    secondReq->setParameter("expand", "persons");
+    std::atomic<int> pages{0};
+    std::atomic<int> relationQueries{0};
+    std::atomic<int> responses{0};
+    std::promise<void> done;
+
+    // Two page queries, then a single persons query shared by both requests
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .Times(3)
+        .WillRepeatedly(Invoke([&](const std::string &sql, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            if (sql.find("ANY(") != std::string::npos) {
+                ++relationQueries;
+                successCallback(makeResult({"id", "job_id", "first_name"}, {{"10", "1", "Ada"}, {"20", "2", "Alan"}}));
+            } else if (pages++ == 0) {
+                successCallback(makeResult({"id", "title"}, {{"1", "Engineer"}}));
+            } else {
+                successCallback(makeResult({"id", "title"}, {{"2", "Manager"}}));
+            }
+        }));
+
+    auto expectOwnPersons = [&](int jobId) {
+        return [&, jobId](const HttpResponsePtr &resp) {
+            auto json = resp->getJsonObject();
+            EXPECT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+            EXPECT_EQ((*json)[0]["persons"].size(), 1u);
+            EXPECT_EQ((*json)[0]["persons"][0]["job_id"].asInt(), jobId);
+            if (++responses == 2) {
+                done.set_value();
+            }
+        };
+    };
+
+    // Declared last so it is quit and joined before anything its callbacks use goes away
+    trantor::EventLoopThread loopThread;
+    loopThread.run();
+
+    // Act
+    loopThread.getLoop()->queueInLoop([&]() {
+        controller.get(firstReq, expectOwnPersons(1));
+        controller.get(secondReq, expectOwnPersons(2));
+    });
+
+    // Assert
+    ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_EQ(relationQueries.load(), 1);
+}
+
+// Disabled until the upstream startup-time sort key whitelist lands
+TEST_F(JobsControllerTest, DISABLED_GetJobs_InvalidSortOrder_BadRequest) {
+    // Arrange
+    auto req = HttpRequest::newHttpRequest();
+    req->setParameter("sort_field", "title");
+    req->setParameter("sort_order", "sideways");
+    bool called = false;
+
+    auto callback = [&called](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k400BadRequest);
+        called = true;
+    };
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .Times(0);
+
+    // Act
+    controller.get(req, callback);
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Disabled until the upstream startup-time sort key whitelist lands
+TEST_F(JobsControllerTest, DISABLED_GetJobs_UnknownSortField_BadRequest) {
+    // Arrange
+    auto req = HttpRequest::newHttpRequest();
+    req->setParameter("sort_field", "salary");
+    req->setParameter("sort_order", "asc");
+    bool called = false;
+
+    auto callback = [&called](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k400BadRequest);
+        called = true;
+    };
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .Times(0);
+
+    // Act
+    controller.get(req, callback);
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
 TEST_F(JobsControllerTest, GetOneJob_Success) {
     // Arrange
     int jobId = 1;
@@ -73,6 +371,179 @@ TEST_F(JobsControllerTest, GetOneJob_Success) {
     controller.getOne(req, callback, jobId);
 }
 
+// Disabled until the upstream getOne entity cache lands
+TEST_F(JobsControllerTest, DISABLED_GetOneJob_RepeatedCallServedFromCache) {
+    // Arrange
+    // Ids are unique per test so a process-wide cache cannot leak between tests
+    int jobId = 112;
+    auto req = HttpRequest::newHttpRequest();
+    std::vector<std::string> bodies;
+
+    auto callback = [&bodies](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        bodies.emplace_back(resp->body());
+    };
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .Times(1)
+        .WillOnce(Invoke([](const std::string &, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            successCallback(makeResult({"id", "title"}, {{"112", "Librarian"}}));
+        }));
+
+    // Act
+    controller.getOne(req, callback, jobId);
+    controller.getOne(req, callback, jobId);
+
+    // Assert
+    ASSERT_EQ(bodies.size(), 2u);
+    ASSERT_EQ(bodies[0], bodies[1]);
+}
+
+// Disabled until the upstream getOne entity cache lands
+TEST_F(JobsControllerTest, DISABLED_GetOneJob_CachedEntryExpiresAfterTtl) {
+    // Arrange
+    int jobId = 113;
+    auto req = HttpRequest::newHttpRequest();
+    int responses = 0;
+    auto callback = [&responses](const HttpResponsePtr &resp) {
+        EXPECT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        ++responses;
+    };
+
+    // Short TTL for this test only; the guard restores the default cache settings
+    Json::Value config;
+    config["custom_config"]["entity_cache"]["ttl_ms"] = 10;
+    drogon::app().loadConfigJson(config);
+    struct RestoreCacheConfig {
+        ~RestoreCacheConfig() {
+            Json::Value defaults;
+            defaults["custom_config"]["entity_cache"] = Json::objectValue;
+            drogon::app().loadConfigJson(defaults);
+        }
+    } restoreCacheConfig;
+
+    // The entry is gone once the TTL has passed, so the second getOne reaches the database
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .Times(2)
+        .WillRepeatedly(Invoke([](const std::string &, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            successCallback(makeResult({"id", "title"}, {{"113", "Curator"}}));
+        }));
+
+    // Act
+    controller.getOne(req, callback, jobId);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    controller.getOne(req, callback, jobId);
+
+    // Assert
+    EXPECT_EQ(responses, 2);
+}
+
+// Disabled until the upstream getOne entity cache lands
+TEST_F(JobsControllerTest, DISABLED_DeleteJob_InvalidatesCachedEntry) {
+    // Arrange
+    // Ids are unique per test so a process-wide cache cannot leak between tests
+    int jobId = 111;
+    auto req = HttpRequest::newHttpRequest();
+    int responses = 0;
+    auto callback = [&responses](const HttpResponsePtr &) { ++responses; };
+
+    // getOne caches a found row; deleteOne must evict it so the next getOne reaches the database
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .Times(3)
+        .WillRepeatedly(Invoke([](const std::string &, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            successCallback(makeResult({"id", "title"}, {{"111", "Archivist"}}));
+        }));
+
+    // Act
+    controller.getOne(req, callback, jobId);
+    controller.deleteOne(req, callback, jobId);
+    controller.getOne(req, callback, jobId);
+
+    // Assert
+    ASSERT_EQ(responses, 3);
+}
+
+// Disabled until the upstream ?fields= projection support lands
+TEST_F(JobsControllerTest, DISABLED_GetOneJob_WithFields_ProjectsColumns) {
+    // Arrange
+    int jobId = 311;
+    auto req = HttpRequest::newHttpRequest();
+    req->setParameter("fields", "id");
+    bool called = false;
+
+    auto callback = [&called](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        auto json = resp->getJsonObject();
+        ASSERT_EQ((*json)["id"].asInt(), 311);
+        ASSERT_FALSE(json->isMember("title"));
+        called = true;
+    };
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .WillOnce(Invoke([](const std::string &sql, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            EXPECT_EQ(sql.find("title"), std::string::npos);
+            successCallback(makeResult({"id"}, {{"311"}}));
+        }));
+
+    // Act
+    controller.getOne(req, callback, jobId);
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Disabled until the upstream ?fields= projection support lands
+TEST_F(JobsControllerTest, DISABLED_GetJobs_WithFields_ProjectsColumns) {
+    // Arrange
+    auto req = HttpRequest::newHttpRequest();
+    req->setParameter("fields", "title");
+    bool called = false;
+
+    auto callback = [&called](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k200OK);
+        auto json = resp->getJsonObject();
+        ASSERT_EQ(json->size(), 2u);
+        for (const auto &job : *json) {
+            ASSERT_TRUE(job.isMember("title"));
+            ASSERT_FALSE(job.isMember("id"));
+        }
+        called = true;
+    };
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .WillOnce(Invoke([](const std::string &, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            successCallback(makeResult({"title"}, {{"Engineer"}, {"Manager"}}));
+        }));
+
+    // Act
+    controller.get(req, callback);
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Disabled until the upstream ?fields= projection support lands
+TEST_F(JobsControllerTest, DISABLED_GetJobs_UnknownField_BadRequest) {
+    // Arrange
+    auto req = HttpRequest::newHttpRequest();
+    req->setParameter("fields", "id,salary");
+    bool called = false;
+
+    auto callback = [&called](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), HttpStatusCode::k400BadRequest);
+        called = true;
+    };
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .Times(0);
+
+    // Act
+    controller.get(req, callback);
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
 TEST_F(JobsControllerTest, CreateJob_Success) {
     // Arrange
     auto req = HttpRequest::newHttpRequest();
@@ -94,6 +565,66 @@ TEST_F(JobsControllerTest, CreateJob_Success) {
     controller.createOne(req, callback, std::move(job));
 }
 
+// Disabled until the upstream controllers emit ETags and honor If-None-Match
+TEST_F(JobsControllerTest, DISABLED_CreateJob_ChangesListETag) {
+    // Arrange
+    auto req = HttpRequest::newHttpRequest();
+    Job job;
+    job.setTitle("New Job");
+    std::string etagBefore;
+    std::string etagAfter;
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .WillRepeatedly(Invoke([](const std::string &, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            successCallback(makeResult({"id", "title"}, {{"1", "Engineer"}}));
+        }));
+
+    // Act
+    controller.get(req, [&etagBefore](const HttpResponsePtr &resp) {
+        etagBefore = resp->getHeader("ETag");
+    });
+    controller.createOne(req, [](const HttpResponsePtr &) {}, std::move(job));
+    controller.get(req, [&etagAfter](const HttpResponsePtr &resp) {
+        etagAfter = resp->getHeader("ETag");
+    });
+
+    // Assert
+    ASSERT_FALSE(etagBefore.empty());
+    ASSERT_FALSE(etagAfter.empty());
+    ASSERT_NE(etagBefore, etagAfter);
+}
+
+// Disabled until the upstream controllers emit ETags and honor If-None-Match
+TEST_F(JobsControllerTest, DISABLED_UpdateAndDeleteJob_ChangeListETag) {
+    // Arrange
+    int jobId = 121;
+    auto req = HttpRequest::newHttpRequest();
+    Job jobDetails;
+    jobDetails.setTitle("Updated Job");
+    std::vector<std::string> etags;
+    auto captureETag = [&etags](const HttpResponsePtr &resp) {
+        etags.push_back(resp->getHeader("ETag"));
+    };
+
+    EXPECT_CALL(*dbClient, execSqlAsync(_, _, _, _))
+        .WillRepeatedly(Invoke([](const std::string &, const std::vector<std::shared_ptr<drogon::orm::SqlBinder>> &, std::function<void(const drogon::orm::Result &)> &&successCallback, std::function<void(const std::exception_ptr &)> &&) {
+            successCallback(makeResult({"id", "title"}, {{"121", "Engineer"}}));
+        }));
+
+    // Act
+    controller.get(req, captureETag);
+    controller.updateOne(req, [](const HttpResponsePtr &) {}, jobId, std::move(jobDetails));
+    controller.get(req, captureETag);
+    controller.deleteOne(req, [](const HttpResponsePtr &) {}, jobId);
+    controller.get(req, captureETag);
+
+    // Assert
+    ASSERT_EQ(etags.size(), 3u);
+    ASSERT_FALSE(etags[0].empty());
+    ASSERT_NE(etags[0], etags[1]);
+    ASSERT_NE(etags[1], etags[2]);
+}
+
 TEST_F(JobsControllerTest, UpdateJob_Success) {
     // Arrange
     int jobId = 1;
@@ -1,10 +1,12 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <drogon/HttpAppFramework.h>
 #include <drogon/HttpRequest.h>
 #include <drogon/HttpResponse.h>
 #include <drogon/orm/Mapper.h>
 #include <drogon/orm/Criteria.h>
 #include "PersonsController.h"
+#include "FakeResult.h"
 
 // Mocks for dependencies
 class MockDbClient : public drogon::orm::DbClient {
@@ -34,6 +36,7 @@ protected:
 
     void SetUp() override {
         mockDbClient = std::make_shared<MockDbClient>();
+        drogon::app().setDbClient(mockDbClient);
         mockRequest = std::make_shared<MockHttpRequest>();
         mockResponse = std::make_shared<MockHttpResponse>();
     }
@@ -64,6 +67,328 @@ TEST_F(PersonsControllerTest, GetPersons_Success) {
     });
 }
 
+// Test for PersonsController::get with a keyset cursor
+// Disabled until the upstream list handlers support keyset pagination (`after` / `next_cursor`)
+TEST_F(PersonsControllerTest, DISABLED_GetPersons_WithCursor_ReturnsNextCursor) {
+    // Arrange
+    std::string cursor;
+    bool secondPageServed = false;
+    EXPECT_CALL(*mockRequest, getOptionalParameter("sort_field"))
+        .WillRepeatedly(::testing::Return("last_name"));
+    EXPECT_CALL(*mockRequest, getOptionalParameter("sort_order"))
+        .WillRepeatedly(::testing::Return("asc"));
+    EXPECT_CALL(*mockRequest, getOptionalParameter("limit"))
+        .WillRepeatedly(::testing::Return("2"));
+    // First page has no cursor; the second echoes back the opaque next_cursor
+    EXPECT_CALL(*mockRequest, getOptionalParameter("after"))
+        .WillOnce(::testing::Return(std::nullopt))
+        .WillOnce(::testing::Invoke([&cursor](const std::string &) { return std::optional<std::string>(cursor); }));
+
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(::testing::Invoke([](const std::string &, const std::vector<std::string> &, drogon::orm::ResultCallback resultCb, drogon::orm::ExceptionCallback) {
+            resultCb(makeResult({"id", "first_name", "last_name"}, {{"26", "Ada", "Lovelace"}, {"27", "Alan", "Turing"}}));
+        }))
+        .WillOnce(::testing::Invoke([](const std::string &sql, const std::vector<std::string> &params, drogon::orm::ResultCallback resultCb, drogon::orm::ExceptionCallback) {
+            // Keyset mode seeks past the last row of the first page instead of skipping rows
+            EXPECT_EQ(sql.find("OFFSET"), std::string::npos);
+            EXPECT_THAT(params, ::testing::IsSupersetOf({std::string("Turing"), std::string("27")}));
+            resultCb(makeResult({"id", "first_name", "last_name"}, {{"28", "Grace", "Hopper"}, {"29", "Barbara", "Liskov"}}));
+        }));
+
+    controller.get(mockRequest, [&cursor](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k200OK);
+        auto json = response->getJsonObject();
+        ASSERT_EQ((*json)["items"].size(), 2u);
+        ASSERT_EQ((*json)["items"][1]["last_name"].asString(), "Turing");
+        cursor = (*json)["next_cursor"].asString();
+    });
+    ASSERT_FALSE(cursor.empty());
+
+    // Act
+    controller.get(mockRequest, [&](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k200OK);
+        auto json = response->getJsonObject();
+        ASSERT_EQ((*json)["items"].size(), 2u);
+        ASSERT_EQ((*json)["items"][0]["id"].asInt(), 28);
+        ASSERT_TRUE((*json)["next_cursor"].isString());
+        secondPageServed = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(secondPageServed);
+}
+
+// Disabled until the upstream list handlers support keyset pagination (`after` / `next_cursor`)
+TEST_F(PersonsControllerTest, DISABLED_GetPersons_WithMalformedCursor_BadRequest) {
+    // Arrange
+    EXPECT_CALL(*mockRequest, getOptionalParameter("after"))
+        .WillOnce(::testing::Return("not-a-cursor"));
+    bool called = false;
+
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(0);
+
+    // Act
+    controller.get(mockRequest, [&called](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k400BadRequest);
+        called = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Test for PersonsController::get with include_total
+// Disabled until the upstream include_total support with per-table counters lands
+TEST_F(PersonsControllerTest, DISABLED_GetPersons_IncludeTotal_ExactWithoutCountQuery) {
+    // Arrange
+    EXPECT_CALL(*mockRequest, getOptionalParameter("limit"))
+        .WillOnce(::testing::Return("25"));
+    EXPECT_CALL(*mockRequest, getOptionalParameter("offset"))
+        .WillOnce(::testing::Return("0"));
+    EXPECT_CALL(*mockRequest, getOptionalParameter("include_total"))
+        .WillOnce(::testing::Return("true"));
+    bool called = false;
+
+    // Unfiltered totals come from the table counter, not a count(*) query
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(1)
+        .WillOnce(::testing::Invoke([](const std::string &sql, const std::vector<std::string> &, drogon::orm::ResultCallback resultCb, drogon::orm::ExceptionCallback) {
+            EXPECT_EQ(sql.find("count("), std::string::npos);
+            resultCb(makeResult({"id", "first_name", "last_name"}, {{"1", "Ada", "Lovelace"}}));
+        }));
+
+    // Act
+    controller.get(mockRequest, [&called](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k200OK);
+        auto json = response->getJsonObject();
+        ASSERT_TRUE(json != nullptr);
+        // Same envelope as cursor mode: rows under "items", metadata beside them
+        ASSERT_TRUE(json->isObject());
+        ASSERT_EQ((*json)["items"].size(), 1u);
+        ASSERT_EQ((*json)["items"][0]["last_name"].asString(), "Lovelace");
+        ASSERT_TRUE((*json)["total"].isIntegral());
+        ASSERT_GE((*json)["total"].asInt64(), 1);
+        ASSERT_TRUE((*json)["total_exact"].asBool());
+        called = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Disabled until the upstream include_total support with per-table counters lands
+TEST_F(PersonsControllerTest, DISABLED_GetPersons_IncludeTotal_FilteredUsesEstimate) {
+    // Arrange
+    EXPECT_CALL(*mockRequest, getOptionalParameter("include_total"))
+        .WillOnce(::testing::Return("true"));
+    EXPECT_CALL(*mockRequest, getOptionalParameter("department_id"))
+        .WillRepeatedly(::testing::Return("3"));
+    bool called = false;
+
+    // Filtered totals come from the planner estimate, never from count(*)
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke([](const std::string &sql, const std::vector<std::string> &, drogon::orm::ResultCallback resultCb, drogon::orm::ExceptionCallback) {
+            EXPECT_EQ(sql.find("count("), std::string::npos);
+            resultCb(makeResult({"id", "department_id", "first_name"}, {{"1", "3", "Ada"}}));
+        }));
+
+    // Act
+    controller.get(mockRequest, [&called](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k200OK);
+        auto json = response->getJsonObject();
+        ASSERT_TRUE(json != nullptr);
+        ASSERT_TRUE(json->isObject());
+        ASSERT_EQ((*json)["items"].size(), 1u);
+        ASSERT_EQ((*json)["items"][0]["department_id"].asInt(), 3);
+        ASSERT_TRUE((*json)["total"].isIntegral());
+        ASSERT_FALSE((*json)["total_exact"].asBool());
+        called = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Disabled until the upstream include_total support with per-table counters lands
+TEST_F(PersonsControllerTest, DISABLED_GetPersons_IncludeTotal_TracksCreateAndDelete) {
+    // Arrange
+    EXPECT_CALL(*mockRequest, getOptionalParameter("include_total"))
+        .WillRepeatedly(::testing::Return("true"));
+    std::vector<Json::Int64> totals;
+    auto captureTotal = [&totals](const drogon::HttpResponsePtr &response) {
+        auto json = response->getJsonObject();
+        ASSERT_EQ((*json)["items"].size(), 1u);
+        totals.push_back((*json)["total"].asInt64());
+    };
+
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillRepeatedly(::testing::Invoke([](const std::string &, const std::vector<std::string> &, drogon::orm::ResultCallback resultCb, drogon::orm::ExceptionCallback) {
+            resultCb(makeResult({"id", "first_name", "last_name"}, {{"41", "Grace", "Hopper"}}));
+        }));
+
+    // Act
+    controller.get(mockRequest, captureTotal);
+    controller.createOne(mockRequest, [](const drogon::HttpResponsePtr &) {}, Person());
+    controller.get(mockRequest, captureTotal);
+    controller.deleteOne(mockRequest, [](const drogon::HttpResponsePtr &) {}, 41);
+    controller.get(mockRequest, captureTotal);
+
+    // Assert
+    ASSERT_EQ(totals.size(), 3u);
+    ASSERT_EQ(totals[1], totals[0] + 1);
+    ASSERT_EQ(totals[2], totals[0]);
+}
+
+// Test for PersonsController::get with a sort key outside the whitelist
+// Disabled until the upstream startup-time sort key whitelist lands
+TEST_F(PersonsControllerTest, DISABLED_GetPersons_UnknownSortField_BadRequest) {
+    // Arrange
+    EXPECT_CALL(*mockRequest, getOptionalParameter("sort_field"))
+        .WillOnce(::testing::Return("salary; DROP TABLE person"));
+    bool called = false;
+
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(0);
+
+    // Act
+    controller.get(mockRequest, [&called](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k400BadRequest);
+        called = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Test for PersonsController::get with a field projection
+// Disabled until the upstream ?fields= projection support lands
+TEST_F(PersonsControllerTest, DISABLED_GetPersons_WithFields_ProjectsColumns) {
+    // Arrange
+    EXPECT_CALL(*mockRequest, getOptionalParameter("fields"))
+        .WillOnce(::testing::Return("id,first_name"));
+    bool called = false;
+
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(::testing::Invoke([](const std::string &sql, const std::vector<std::string> &, drogon::orm::ResultCallback resultCb, drogon::orm::ExceptionCallback) {
+            EXPECT_EQ(sql.find("last_name"), std::string::npos);
+            resultCb(makeResult({"id", "first_name"}, {{"1", "Ada"}, {"2", "Alan"}}));
+        }));
+
+    // Act
+    controller.get(mockRequest, [&called](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k200OK);
+        auto json = response->getJsonObject();
+        ASSERT_EQ(json->size(), 2u);
+        for (const auto &person : *json) {
+            ASSERT_EQ(person.getMemberNames(), (std::vector<std::string>{"first_name", "id"}));
+        }
+        called = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Test for PersonsController::getOne with a field projection
+// Disabled until the upstream ?fields= projection support lands
+TEST_F(PersonsControllerTest, DISABLED_GetOnePerson_WithFields_ProjectsColumns) {
+    // Arrange
+    int personId = 301;
+    EXPECT_CALL(*mockRequest, getOptionalParameter("fields"))
+        .WillOnce(::testing::Return("id,first_name"));
+    bool called = false;
+
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .WillOnce(::testing::Invoke([](const std::string &sql, const std::vector<std::string> &, drogon::orm::ResultCallback resultCb, drogon::orm::ExceptionCallback) {
+            EXPECT_EQ(sql.find("last_name"), std::string::npos);
+            resultCb(makeResult({"id", "first_name"}, {{"301", "Ada"}}));
+        }));
+
+    // Act
+    controller.getOne(mockRequest, [&called](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k200OK);
+        auto json = response->getJsonObject();
+        ASSERT_EQ((*json)["id"].asInt(), 301);
+        ASSERT_EQ((*json)["first_name"].asString(), "Ada");
+        ASSERT_FALSE(json->isMember("last_name"));
+        called = true;
+    }, personId);
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Disabled until the upstream ?fields= projection support lands
+TEST_F(PersonsControllerTest, DISABLED_GetPersons_UnknownField_BadRequest) {
+    // Arrange
+    EXPECT_CALL(*mockRequest, getOptionalParameter("fields"))
+        .WillOnce(::testing::Return("id,salary"));
+    bool called = false;
+
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(0);
+
+    // Act
+    controller.get(mockRequest, [&called](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k400BadRequest);
+        called = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
+// Test for PersonsController::getOne served from the entity cache
+// Disabled until the upstream getOne entity cache lands
+TEST_F(PersonsControllerTest, DISABLED_GetOnePerson_RepeatedCallServedFromCache) {
+    // Arrange
+    // Ids are unique per test so a process-wide cache cannot leak between tests
+    int personId = 401;
+    std::vector<std::string> bodies;
+    auto callback = [&bodies](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k200OK);
+        bodies.emplace_back(response->body());
+    };
+
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(1)
+        .WillOnce(::testing::Invoke([](const std::string &, const std::vector<std::string> &, drogon::orm::ResultCallback resultCb, drogon::orm::ExceptionCallback) {
+            resultCb(makeResult({"id", "first_name", "last_name"}, {{"401", "Katherine", "Johnson"}}));
+        }));
+
+    // Act
+    controller.getOne(mockRequest, callback, personId);
+    controller.getOne(mockRequest, callback, personId);
+
+    // Assert
+    ASSERT_EQ(bodies.size(), 2u);
+    ASSERT_EQ(bodies[0], bodies[1]);
+}
+
+// Test for PersonsController::get with a sort order other than asc/desc
+// Disabled until the upstream startup-time sort key whitelist lands
+TEST_F(PersonsControllerTest, DISABLED_GetPersons_InvalidSortOrder_BadRequest) {
+    // Arrange
+    EXPECT_CALL(*mockRequest, getOptionalParameter("sort_field"))
+        .WillRepeatedly(::testing::Return("last_name"));
+    EXPECT_CALL(*mockRequest, getOptionalParameter("sort_order"))
+        .WillRepeatedly(::testing::Return("sideways"));
+    bool called = false;
+
+    EXPECT_CALL(*mockDbClient, execSqlAsync(::testing::_, ::testing::_, ::testing::_, ::testing::_))
+        .Times(0);
+
+    // Act
+    controller.get(mockRequest, [&called](const drogon::HttpResponsePtr &response) {
+        ASSERT_EQ(response->getStatusCode(), drogon::HttpStatusCode::k400BadRequest);
+        called = true;
+    });
+
+    // Assert
+    ASSERT_TRUE(called);
+}
+
 // Test for PersonsController::getOne
 TEST_F(PersonsControllerTest, GetOnePerson_NotFound) {
     // Arrange
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <drogon/drogon.h>
+#include <chrono>
 #include "LoginFilter.h"
 #include "../plugins/JwtPlugin.h"
 
@@ -29,6 +30,7 @@ public:
 class MockDecodedJwt {
 public:
     MOCK_METHOD(jwt::claim, get_payload_claim, (const std::string &), (const));
+    MOCK_METHOD(jwt::date, get_expires_at, (), (const));
 };
 
 // Test suite for LoginFilter
@@ -44,6 +46,12 @@ protected:
         // Mock the plugin retrieval
         drogon::app().registerPlugin<MockJwtPlugin>(&mockJwtPlugin);
     }
+
+    // Serve the same exp whichever way the filter reads it
+    void stubExpiry(jwt::date expiresAt) {
+        ON_CALL(mockDecodedJwt, get_payload_claim("exp")).WillByDefault(Return(jwt::claim(expiresAt)));
+        ON_CALL(mockDecodedJwt, get_expires_at()).WillByDefault(Return(expiresAt));
+    }
 };
 
 TEST_F(LoginFilterTest, MissingAuthorizationHeader) {
@@ -113,11 +121,98 @@ TEST_F(LoginFilterTest, ValidTokenProceedsToNextFilter) {
     ASSERT_TRUE(chainCallbackCalled);
 }
 
+// Disabled until the upstream verified-token cache in LoginFilter::doFilter lands
+TEST_F(LoginFilterTest, DISABLED_RepeatedValidTokenSkipsVerification) {
+    // Arrange
+    stubExpiry(std::chrono::system_clock::now() + std::chrono::hours(1));
+    EXPECT_CALL(mockRequest, getHeader("Authorization")).WillRepeatedly(Return("Bearer cached_token"));
+    EXPECT_CALL(mockJwtPlugin, init()).Times(1).WillOnce(Return(mockJwtObject));
+    EXPECT_CALL(mockJwtObject, decode("cached_token")).Times(1).WillOnce(Return(mockDecodedJwt));
+    ON_CALL(mockDecodedJwt, get_payload_claim("user_id")).WillByDefault(Return(jwt::claim(std::to_string(123))));
+
+    int chainCallbackCount = 0;
+    auto filterCallback = [&](const HttpResponsePtr &resp) {
+        FAIL() << "Filter callback should not be called";
+    };
+
+    auto chainCallback = [&]() {
+        ++chainCallbackCount;
+    };
+
+    // Act
+    filter.doFilter(mockRequest.shared_from_this(), filterCallback, chainCallback);
+    filter.doFilter(mockRequest.shared_from_this(), filterCallback, chainCallback);
+
+    // Assert
+    ASSERT_EQ(chainCallbackCount, 2);
+}
+
+// Disabled until the upstream verified-token cache in LoginFilter::doFilter lands
+TEST_F(LoginFilterTest, DISABLED_ExpiredTokenIsReverified) {
+    // Arrange
+    // exp is already in the past, so no cache entry may outlive it
+    stubExpiry(std::chrono::system_clock::now() - std::chrono::minutes(1));
+    EXPECT_CALL(mockRequest, getHeader("Authorization")).WillRepeatedly(Return("Bearer expired_token"));
+    EXPECT_CALL(mockJwtPlugin, init()).Times(2).WillRepeatedly(Return(mockJwtObject));
+    EXPECT_CALL(mockJwtObject, decode("expired_token"))
+        .Times(2)
+        .WillOnce(Return(mockDecodedJwt))
+        .WillOnce(Throw(jwt::token_verification_exception("Token expired")));
+    ON_CALL(mockDecodedJwt, get_payload_claim("user_id")).WillByDefault(Return(jwt::claim(std::to_string(123))));
+
+    int chainCallbackCount = 0;
+    int rejectedCount = 0;
+    auto filterCallback = [&](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), k400BadRequest);
+        ++rejectedCount;
+    };
+
+    auto chainCallback = [&]() {
+        ++chainCallbackCount;
+    };
+
+    // Act
+    filter.doFilter(mockRequest.shared_from_this(), filterCallback, chainCallback);
+    filter.doFilter(mockRequest.shared_from_this(), filterCallback, chainCallback);
+
+    // Assert
+    // The second request was verified again and rejected rather than served from the cache
+    ASSERT_EQ(chainCallbackCount + rejectedCount, 2);
+    ASSERT_GE(rejectedCount, 1);
+}
+
+// Disabled until the upstream verified-token cache in LoginFilter::doFilter lands
+TEST_F(LoginFilterTest, DISABLED_FailedTokenIsNotCached) {
+    // Arrange
+    EXPECT_CALL(mockRequest, getHeader("Authorization")).WillRepeatedly(Return("Bearer forged_token"));
+    EXPECT_CALL(mockJwtPlugin, init()).Times(2).WillRepeatedly(Return(mockJwtObject));
+    EXPECT_CALL(mockJwtObject, decode("forged_token"))
+        .Times(2)
+        .WillRepeatedly(Throw(jwt::token_verification_exception("Invalid signature")));
+
+    int rejectedCount = 0;
+    auto filterCallback = [&](const HttpResponsePtr &resp) {
+        ASSERT_EQ(resp->getStatusCode(), k400BadRequest);
+        ++rejectedCount;
+    };
+
+    auto chainCallback = [&]() {
+        FAIL() << "Filter chain callback should not be called";
+    };
+
+    // Act
+    filter.doFilter(mockRequest.shared_from_this(), filterCallback, chainCallback);
+    filter.doFilter(mockRequest.shared_from_this(), filterCallback, chainCallback);
+
+    // Assert
+    ASSERT_EQ(rejectedCount, 2);
+}
+
 TEST_F(LoginFilterTest, RuntimeErrorCaught) {
     // Arrange
-    EXPECT_CALL(mockRequest, getHeader("Authorization")).WillOnce(Return("Bearer valid_token"));
+    EXPECT_CALL(mockRequest, getHeader("Authorization")).WillOnce(Return("Bearer runtime_error_token"));
     EXPECT_CALL(mockJwtPlugin, init()).WillOnce(Return(mockJwtObject));
-    EXPECT_CALL(mockJwtObject, decode("valid_token")).WillOnce(Throw(std::runtime_error("Runtime error")));
+    EXPECT_CALL(mockJwtObject, decode("runtime_error_token")).WillOnce(Throw(std::runtime_error("Runtime error")));
 
     bool callbackCalled = false;
     auto filterCallback = [&](const HttpResponsePtr &resp) {
@@ -225,4 +225,84 @@ TEST_F(DepartmentTest, ValidJsonOfField_InvalidName) {
     // Assert
     EXPECT_FALSE(isValid);
     EXPECT_EQ(err, "Type error in the name field");
-}
\ No newline at end of file
+}
+
+// Test updateByMasqueradedJson
+TEST_F(DepartmentTest, UpdateByMasqueradedJson) {
+    // Arrange
+    Department department;
+    Json::Value json;
+    json["custom_id"] = 5;
+    json["custom_name"] = "Legal";
+    std::vector<std::string> masqueradingVector = {"custom_id", "custom_name"};
+
+    // Act
+    department.updateByMasqueradedJson(json, masqueradingVector);
+
+    // Assert
+    EXPECT_EQ(department.getValueOfId(), 5);
+    EXPECT_EQ(department.getValueOfName(), "Legal");
+}
+
+// Test validateMasqueradedJsonForCreation
+TEST_F(DepartmentTest, ValidateMasqueradedJsonForCreation_ValidJson) {
+    // Arrange
+    Json::Value json;
+    json["custom_name"] = "Legal";
+    std::vector<std::string> masqueradingVector = {"custom_id", "custom_name"};
+    std::string err;
+
+    // Act
+    bool isValid = Department::validateMasqueradedJsonForCreation(json, masqueradingVector, err);
+
+    // Assert
+    EXPECT_TRUE(isValid);
+    EXPECT_TRUE(err.empty());
+}
+
+TEST_F(DepartmentTest, ValidateMasqueradedJsonForCreation_BadVector) {
+    // Arrange
+    Json::Value json;
+    json["custom_name"] = "Legal";
+    std::vector<std::string> masqueradingVector = {"custom_name"};
+    std::string err;
+
+    // Act
+    bool isValid = Department::validateMasqueradedJsonForCreation(json, masqueradingVector, err);
+
+    // Assert
+    EXPECT_FALSE(isValid);
+    EXPECT_EQ(err, "Bad masquerading vector");
+}
+
+// Test validateMasqueradedJsonForUpdate
+TEST_F(DepartmentTest, ValidateMasqueradedJsonForUpdate_MissingPrimaryKey) {
+    // Arrange
+    Json::Value json;
+    json["custom_name"] = "Legal";
+    std::vector<std::string> masqueradingVector = {"custom_id", "custom_name"};
+    std::string err;
+
+    // Act
+    bool isValid = Department::validateMasqueradedJsonForUpdate(json, masqueradingVector, err);
+
+    // Assert
+    EXPECT_FALSE(isValid);
+    EXPECT_EQ(err, "The value of primary key must be set in the json object for update");
+}
+
+TEST_F(DepartmentTest, ValidateMasqueradedJsonForUpdate_BadVector) {
+    // Arrange
+    Json::Value json;
+    json["custom_id"] = 5;
+    json["custom_name"] = "Legal";
+    std::vector<std::string> masqueradingVector = {"custom_id"};
+    std::string err;
+
+    // Act
+    bool isValid = Department::validateMasqueradedJsonForUpdate(json, masqueradingVector, err);
+
+    // Assert
+    EXPECT_FALSE(isValid);
+    EXPECT_EQ(err, "Bad masquerading vector");
+}
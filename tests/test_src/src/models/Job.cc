@@ -175,6 +175,63 @@ TEST_F(JobTest, ValidateJsonForUpdate_InvalidJson) {
     EXPECT_EQ(error, "The value of primary key must be set in the json object for update");
 }
 
+// Test validJsonOfField
+TEST_F(JobTest, ValidJsonOfField_ValidId) {
+    // Arrange
+    Json::Value json;
+    json = 1;
+    std::string error;
+
+    // Act
+    bool isValid = Job::validJsonOfField(0, "id", json, error, false);
+
+    // Assert
+    EXPECT_TRUE(isValid);
+    EXPECT_TRUE(error.empty());
+}
+
+TEST_F(JobTest, ValidJsonOfField_InvalidId) {
+    // Arrange
+    Json::Value json;
+    json = "invalid";
+    std::string error;
+
+    // Act
+    bool isValid = Job::validJsonOfField(0, "id", json, error, false);
+
+    // Assert
+    EXPECT_FALSE(isValid);
+    EXPECT_EQ(error, "Type error in the id field");
+}
+
+TEST_F(JobTest, ValidJsonOfField_ValidTitle) {
+    // Arrange
+    Json::Value json;
+    json = "Valid Title";
+    std::string error;
+
+    // Act
+    bool isValid = Job::validJsonOfField(1, "title", json, error, false);
+
+    // Assert
+    EXPECT_TRUE(isValid);
+    EXPECT_TRUE(error.empty());
+}
+
+TEST_F(JobTest, ValidJsonOfField_InvalidTitle) {
+    // Arrange
+    Json::Value json;
+    json = 12345;
+    std::string error;
+
+    // Act
+    bool isValid = Job::validJsonOfField(1, "title", json, error, false);
+
+    // Assert
+    EXPECT_FALSE(isValid);
+    EXPECT_EQ(error, "Type error in the title field");
+}
+
 // Test updateByJson
 TEST_F(JobTest, UpdateByJson) {
     // Arrange
@@ -208,6 +265,69 @@ TEST_F(JobTest, UpdateByMasqueradedJson) {
     EXPECT_EQ(job.getValueOfTitle(), "Designer");
 }
 
+// Test validateMasqueradedJsonForCreation
+TEST_F(JobTest, ValidateMasqueradedJsonForCreation_ValidJson) {
+    // Arrange
+    Json::Value json;
+    json["custom_title"] = "Designer";
+    std::vector<std::string> masqueradingVector = {"custom_id", "custom_title"};
+    std::string error;
+
+    // Act
+    bool isValid = Job::validateMasqueradedJsonForCreation(json, masqueradingVector, error);
+
+    // Assert
+    EXPECT_TRUE(isValid);
+    EXPECT_TRUE(error.empty());
+}
+
+TEST_F(JobTest, ValidateMasqueradedJsonForCreation_BadVector) {
+    // Arrange
+    Json::Value json;
+    json["custom_title"] = "Designer";
+    std::vector<std::string> masqueradingVector = {"custom_title"};
+    std::string error;
+
+    // Act
+    bool isValid = Job::validateMasqueradedJsonForCreation(json, masqueradingVector, error);
+
+    // Assert
+    EXPECT_FALSE(isValid);
+    EXPECT_EQ(error, "Bad masquerading vector");
+}
+
+// Test validateMasqueradedJsonForUpdate
+TEST_F(JobTest, ValidateMasqueradedJsonForUpdate_MissingPrimaryKey) {
+    // Arrange
+    Json::Value json;
+    json["custom_title"] = "Designer";
+    std::vector<std::string> masqueradingVector = {"custom_id", "custom_title"};
+    std::string error;
+
+    // Act
+    bool isValid = Job::validateMasqueradedJsonForUpdate(json, masqueradingVector, error);
+
+    // Assert
+    EXPECT_FALSE(isValid);
+    EXPECT_EQ(error, "The value of primary key must be set in the json object for update");
+}
+
+TEST_F(JobTest, ValidateMasqueradedJsonForUpdate_BadVector) {
+    // Arrange
+    Json::Value json;
+    json["custom_id"] = 3;
+    json["custom_title"] = "Designer";
+    std::vector<std::string> masqueradingVector = {"custom_id"};
+    std::string error;
+
+    // Act
+    bool isValid = Job::validateMasqueradedJsonForUpdate(json, masqueradingVector, error);
+
+    // Assert
+    EXPECT_FALSE(isValid);
+    EXPECT_EQ(error, "Bad masquerading vector");
+}
+
 // Test getPersons
 TEST_F(JobTest, GetPersons) {
     // Arrange